@@ -6,6 +6,8 @@
 #include <cmath>
 #include <cstring>
 #include <iostream>
+#include <limits>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -45,6 +47,52 @@ std::vector<Partition> DiskGeometry::get_partitions() const {
   return partitions;
 }
 
+ConcurrentDiskGeometry::ConcurrentDiskGeometry(
+    const std::shared_ptr<DiskGeometry> &p_disk_geometry)
+    : DiskGeometry(p_disk_geometry->get_disk_total_sectors() *
+                       p_disk_geometry->get_bytes_per_sector(),
+                   p_disk_geometry->get_bytes_per_sector()),
+      disk_geometry(p_disk_geometry) {
+  physical_drive = p_disk_geometry->get_physical_drive();
+  partitions = p_disk_geometry->get_partitions();
+}
+
+uint64_t ConcurrentDiskGeometry::get_last_sector(
+    size_t p_starting_sector, size_t p_size, const std::string &p_error) const {
+  uint64_t sector_count =
+      p_size / bytes_per_sector + (p_size % bytes_per_sector != 0);
+  sector_count = std::max<uint64_t>(sector_count, 1);
+  if (std::numeric_limits<uint64_t>::max() - p_starting_sector <
+      sector_count - 1) {
+    throw std::out_of_range(p_error);
+  }
+  return p_starting_sector + sector_count - 1;
+}
+
+size_t ConcurrentDiskGeometry::write_data(const Partition &p_partition,
+                                          size_t p_starting_sector,
+                                          const int8_t *p_data,
+                                          size_t p_data_size,
+                                          std::error_code &p_ec) {
+  SectorRangeLock::Guard guard = sector_lock.lock_exclusive(
+      p_starting_sector,
+      get_last_sector(p_starting_sector, p_data_size,
+                      "Writing outside the partition"));
+  return disk_geometry->write_data(p_partition, p_starting_sector, p_data,
+                                   p_data_size, p_ec);
+}
+
+std::vector<int8_t> ConcurrentDiskGeometry::read_data(
+    const Partition &p_partition, size_t p_starting_sector, size_t p_read_size,
+    std::error_code &p_ec) {
+  SectorRangeLock::Guard guard = sector_lock.lock_shared(
+      p_starting_sector,
+      get_last_sector(p_starting_sector, p_read_size,
+                      "Reading outside the partition"));
+  return disk_geometry->read_data(p_partition, p_starting_sector, p_read_size,
+                                  p_ec);
+}
+
 #if defined(_WIN32) || defined(_WIN64)
 
 size_t WindowsDiskGeometry::write_data(const Partition &p_partition,
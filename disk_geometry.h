@@ -1,7 +1,10 @@
 #ifndef DISK_GEOMETRY_H
 #define DISK_GEOMETRY_H
 
+#include "sector_range_lock.h"
+
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <system_error>
 #include <vector>
@@ -42,6 +45,28 @@ protected:
   std::vector<Partition> partitions;
 };
 
+// Makes one DiskGeometry safe to share between threads. Reads of a sector
+// range run alongside any other reads and any disjoint writes; a write waits
+// for every overlapping read or write before it touches the device.
+class ConcurrentDiskGeometry : public DiskGeometry {
+public:
+  ConcurrentDiskGeometry(const std::shared_ptr<DiskGeometry> &p_disk_geometry);
+
+  size_t write_data(const Partition &p_partition, size_t p_starting_sector,
+                    const int8_t *p_data, size_t p_data_size,
+                    std::error_code &p_ec) override;
+  std::vector<int8_t> read_data(const Partition &p_partition,
+                                size_t p_starting_sector, size_t p_read_size,
+                                std::error_code &p_ec) override;
+
+private:
+  uint64_t get_last_sector(size_t p_starting_sector, size_t p_size,
+                           const std::string &p_error) const;
+
+  std::shared_ptr<DiskGeometry> disk_geometry;
+  SectorRangeLock sector_lock;
+};
+
 #if defined(_WIN32) || defined(_WIN64)
 
 class WindowsDiskGeometry : public DiskGeometry {
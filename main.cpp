@@ -13,6 +13,8 @@ int main()
     // to get the physical device use the following command in Terminal: lsblk
     disk_geometry = std::make_shared<LinuxDiskGeometry>("/dev/sda");
 #endif
+    // wrap the device so the same instance can be handed to several threads
+    disk_geometry = std::make_shared<ConcurrentDiskGeometry>(disk_geometry);
     std::vector<Partition> partitions = disk_geometry->get_partitions();
 
     std::cout << "Number of partitions: " << partitions.size() << std::endl;
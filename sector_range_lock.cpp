@@ -0,0 +1,69 @@
+
+#include "sector_range_lock.h"
+
+#include <stdexcept>
+
+SectorRangeLock::Guard::Guard(SectorRangeLock *p_owner,
+                              RequestList::iterator p_request)
+    : owner(p_owner), request(p_request) {}
+
+SectorRangeLock::Guard::Guard(Guard &&p_other) noexcept
+    : owner(p_other.owner), request(p_other.request) {
+  p_other.owner = nullptr;
+}
+
+SectorRangeLock::Guard::~Guard() {
+  if (owner) {
+    owner->release(request);
+  }
+}
+
+SectorRangeLock::Guard
+SectorRangeLock::lock_shared(uint64_t p_first_sector, uint64_t p_last_sector) {
+  return acquire(p_first_sector, p_last_sector, false);
+}
+
+SectorRangeLock::Guard
+SectorRangeLock::lock_exclusive(uint64_t p_first_sector,
+                                uint64_t p_last_sector) {
+  return acquire(p_first_sector, p_last_sector, true);
+}
+
+SectorRangeLock::Guard SectorRangeLock::acquire(uint64_t p_first_sector,
+                                                uint64_t p_last_sector,
+                                                bool p_exclusive) {
+  if (p_last_sector < p_first_sector) {
+    throw std::invalid_argument("Sector range ends before it starts");
+  }
+
+  std::unique_lock<std::mutex> lock(mutex);
+  RequestList::iterator request = requests.emplace(
+      requests.end(), p_first_sector, p_last_sector, p_exclusive);
+  released.wait(lock, [&] { return !is_blocked(request); });
+  return Guard(this, request);
+}
+
+void SectorRangeLock::release(RequestList::iterator p_request) {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    requests.erase(p_request);
+  }
+  released.notify_all();
+}
+
+// A request may proceed once no earlier request, held or still waiting,
+// overlaps it in a conflicting mode. Checking waiters as well keeps a stream
+// of readers from starving a writer on the same sectors.
+bool SectorRangeLock::is_blocked(RequestList::const_iterator p_request) const {
+  for (RequestList::const_iterator it = requests.begin(); it != p_request;
+       ++it) {
+    if (!it->exclusive && !p_request->exclusive) {
+      continue;
+    }
+    if (it->first_sector <= p_request->last_sector &&
+        p_request->first_sector <= it->last_sector) {
+      return true;
+    }
+  }
+  return false;
+}
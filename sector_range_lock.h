@@ -0,0 +1,61 @@
+#ifndef SECTOR_RANGE_LOCK_H
+#define SECTOR_RANGE_LOCK_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <list>
+#include <mutex>
+
+// Reader/writer lock over inclusive sector ranges. Disjoint ranges never
+// block each other; overlapping ranges are granted in arrival order, with
+// shared holders admitted together and exclusive holders alone.
+class SectorRangeLock {
+  struct Request {
+    Request(const uint64_t p_first_sector, const uint64_t p_last_sector,
+            bool p_exclusive)
+        : first_sector(p_first_sector), last_sector(p_last_sector),
+          exclusive(p_exclusive) {}
+    uint64_t first_sector;
+    uint64_t last_sector;
+    bool exclusive;
+  };
+  using RequestList = std::list<Request>;
+
+public:
+  class Guard {
+  public:
+    Guard(Guard &&p_other) noexcept;
+    Guard(const Guard &) = delete;
+    Guard &operator=(const Guard &) = delete;
+    Guard &operator=(Guard &&) = delete;
+    ~Guard();
+
+  private:
+    friend class SectorRangeLock;
+    Guard(SectorRangeLock *p_owner, RequestList::iterator p_request);
+
+    SectorRangeLock *owner;
+    RequestList::iterator request;
+  };
+
+  SectorRangeLock() = default;
+  SectorRangeLock(const SectorRangeLock &) = delete;
+  SectorRangeLock &operator=(const SectorRangeLock &) = delete;
+
+  Guard lock_shared(uint64_t p_first_sector, uint64_t p_last_sector);
+  Guard lock_exclusive(uint64_t p_first_sector, uint64_t p_last_sector);
+
+private:
+  Guard acquire(uint64_t p_first_sector, uint64_t p_last_sector,
+                bool p_exclusive);
+  void release(RequestList::iterator p_request);
+  bool is_blocked(RequestList::const_iterator p_request) const;
+
+  std::mutex mutex;
+  std::condition_variable released;
+  // Held and waiting requests in arrival order. Its length is bounded by the
+  // number of threads using the lock, so a linear scan beats a tree here.
+  RequestList requests;
+};
+
+#endif // !SECTOR_RANGE_LOCK_H